@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   affinity.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:01:01 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:13:04 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	usable_cpus(cpu_set_t *cpus)
+{
+	CPU_ZERO(cpus);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), cpus) != 0)
+		return (0);
+	return (CPU_COUNT(cpus));
+}
+
+int	count_cpus(void)
+{
+	cpu_set_t	cpus;
+	long		count;
+
+	count = usable_cpus(&cpus);
+	if (count < 1)
+		count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (count < 1)
+		count = 1;
+	return (count);
+}
+
+void	assign_shard_cpus(t_data *data)
+{
+	cpu_set_t	cpus;
+	int			count;
+	int			rank;
+	int			cpu;
+	int			i;
+
+	count = usable_cpus(&cpus);
+	if (data->nb_monitors < 2 || count < data->nb_monitors)
+		return ;
+	rank = 0;
+	cpu = 0;
+	while (cpu < CPU_SETSIZE && rank < count)
+	{
+		if (CPU_ISSET(cpu, &cpus))
+		{
+			i = rank++ * data->nb_monitors / count;
+			CPU_SET(cpu, &data->monitors[i].cpus);
+			data->monitors[i].pinned = 1;
+		}
+		cpu++;
+	}
+}
+
+void	pin_to_shard(t_monitor *mon)
+{
+	if (mon->pinned)
+		sched_setaffinity(0, sizeof(cpu_set_t), &mon->cpus);
+}
@@ -0,0 +1,14 @@
+#!/bin/bash
+# Usage: ./bench.sh <profile> <philo arguments...>
+# Prints events, wall time, CPU time and event throughput for one run.
+
+profile=$1
+shift
+TIMEFORMAT='%R %U %S'
+times=$( { time ./philo "$@" > bench.out; } 2>&1 )
+events=$(wc -l < bench.out)
+rm -f bench.out
+read -r real user sys <<< "$times"
+awk -v p="$profile" -v s="$*" -v e="$events" -v r="$real" -v u="$user" \
+	-v k="$sys" 'BEGIN { printf "%-16s %-22s %7d events %7.2fs real " \
+	"%6.2fs cpu %9.0f events/s\n", p, s, e, r, u + k, e / r }'
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_scan.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:49:54 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 09:49:54 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+long	min_deadline_scalar(long *deadlines, int n)
+{
+	long	earliest;
+	long	value;
+	int		i;
+
+	earliest = LONG_MAX;
+	i = 0;
+	while (i < n)
+	{
+		value = __atomic_load_n(&deadlines[i], __ATOMIC_RELAXED);
+		if (value < earliest)
+			earliest = value;
+		i++;
+	}
+	return (earliest);
+}
+
+int	first_expired(long *deadlines, int n, long now)
+{
+	int	i;
+
+	i = 0;
+	while (i < n)
+	{
+		if (__atomic_load_n(&deadlines[i], __ATOMIC_RELAXED) < now)
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+void	set_deadline(t_philo *philo, long deadline)
+{
+	__atomic_store_n(&philo->data->deadlines[philo->id - 1], deadline,
+		__ATOMIC_RELEASE);
+}
+
+long	get_deadline(t_data *data, int i)
+{
+	return (__atomic_load_n(&data->deadlines[i], __ATOMIC_ACQUIRE));
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deadline_simd.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:49:54 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:31:53 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+#if defined(__x86_64__)
+# include <immintrin.h>
+
+__attribute__((target("avx2")))
+static __m256i	min_epi64_avx2(__m256i a, __m256i b)
+{
+	return (_mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)));
+}
+
+__attribute__((target("avx2")))
+static long	min_deadline_avx2(long *deadlines, int n)
+{
+	__m256i	best[2];
+	long	lanes[8];
+	long	earliest;
+	int		i;
+
+	best[0] = _mm256_set1_epi64x(LONG_MAX);
+	best[1] = best[0];
+	i = 0;
+	while (i + 8 <= n)
+	{
+		best[0] = min_epi64_avx2(best[0],
+				_mm256_loadu_si256((__m256i *)(deadlines + i)));
+		best[1] = min_epi64_avx2(best[1],
+				_mm256_loadu_si256((__m256i *)(deadlines + i + 4)));
+		i += 8;
+	}
+	_mm256_storeu_si256((__m256i *)lanes, best[0]);
+	_mm256_storeu_si256((__m256i *)(lanes + 4), best[1]);
+	earliest = min_deadline_scalar(lanes, 8);
+	lanes[0] = min_deadline_scalar(deadlines + i, n - i);
+	if (lanes[0] < earliest)
+		earliest = lanes[0];
+	return (earliest);
+}
+
+__attribute__((target("sse4.2")))
+static long	min_deadline_sse42(long *deadlines, int n)
+{
+	__m128i	best;
+	__m128i	v;
+	long	lanes[2];
+	long	earliest;
+	int		i;
+
+	best = _mm_set1_epi64x(LONG_MAX);
+	i = 0;
+	while (i + 2 <= n)
+	{
+		v = _mm_loadu_si128((__m128i *)(deadlines + i));
+		best = _mm_blendv_epi8(best, v, _mm_cmpgt_epi64(best, v));
+		i += 2;
+	}
+	_mm_storeu_si128((__m128i *)lanes, best);
+	earliest = min_deadline_scalar(deadlines + i, n - i);
+	if (lanes[0] < earliest)
+		earliest = lanes[0];
+	if (lanes[1] < earliest)
+		earliest = lanes[1];
+	return (earliest);
+}
+
+t_scan	select_deadline_scan(void)
+{
+	if (!SCAN_SIMD)
+		return (min_deadline_scalar);
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return (min_deadline_avx2);
+	if (__builtin_cpu_supports("sse4.2"))
+		return (min_deadline_sse42);
+	return (min_deadline_scalar);
+}
+#else
+
+t_scan	select_deadline_scan(void)
+{
+	return (min_deadline_scalar);
+}
+#endif
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_bitmask.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:44:28 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:46:23 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	try_claim(uint64_t *word, uint64_t mask)
+{
+	uint64_t	old;
+
+	old = __atomic_load_n(word, __ATOMIC_RELAXED);
+	while (!(old & mask))
+	{
+		if (__atomic_compare_exchange_n(word, &old, old | mask, 1,
+				__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			return (1);
+	}
+	return (0);
+}
+
+static int	claim_pair(uint64_t *bits, int left, int right)
+{
+	if (left / 64 == right / 64)
+		return (try_claim(&bits[left / 64],
+				(1ULL << (left % 64)) | (1ULL << (right % 64))));
+	if (!try_claim(&bits[left / 64], 1ULL << (left % 64)))
+		return (0);
+	if (try_claim(&bits[right / 64], 1ULL << (right % 64)))
+		return (1);
+	__atomic_fetch_and(&bits[left / 64], ~(1ULL << (left % 64)),
+		__ATOMIC_RELEASE);
+	return (0);
+}
+
+static int	is_hungrier(t_philo *philo, t_philo *other)
+{
+	return (__atomic_load_n(&other->waiting, __ATOMIC_ACQUIRE)
+		&& get_deadline(philo->data, other->id - 1)
+		< get_deadline(philo->data, philo->id - 1));
+}
+
+static int	can_claim(t_philo *philo)
+{
+	t_data	*data;
+	int		left;
+	int		right;
+
+	data = philo->data;
+	left = philo->id - 1;
+	right = philo->id % data->nb_philos;
+	if (data->sched.mode == SCHED_REPLAY)
+		return (claim_pair(data->fork_bits, left, right));
+	return (!is_hungrier(philo, &data->philos[(left + data->nb_philos - 1)
+				% data->nb_philos])
+		&& !is_hungrier(philo, &data->philos[right])
+		&& claim_pair(data->fork_bits, left, right));
+}
+
+int	take_fork_pair(t_philo *philo)
+{
+	int	*events;
+	int	left;
+	int	seen;
+
+	left = philo->id - 1;
+	events = &philo->data->fork_events[left / 64];
+	if (wait_grant_turn(philo, left))
+		return (1);
+	__atomic_store_n(&philo->waiting, 1, __ATOMIC_RELEASE);
+	seen = __atomic_load_n(events, __ATOMIC_ACQUIRE);
+	while (!can_claim(philo))
+	{
+		if (check_death_during_sleep(philo))
+			return (stop_fork_wait(philo), 1);
+		futex_wait_bits(events, seen, 1U << (left % 32));
+		seen = __atomic_load_n(events, __ATOMIC_ACQUIRE);
+	}
+	__atomic_store_n(&philo->waiting, 0, __ATOMIC_RELEASE);
+	record_grant(philo, left);
+	print_action_ts(philo, "has taken a fork");
+	print_action_ts(philo, "has taken a fork");
+	return (0);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   forks_wait.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:27:04 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:46:23 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	wake_philo(t_data *data, int i)
+{
+	int	*events;
+
+	events = &data->fork_events[i / 64];
+	__atomic_add_fetch(events, 1, __ATOMIC_RELEASE);
+	futex_wake_bits(events, 1U << (i % 32));
+}
+
+static void	wake_neighbours(t_data *data, int i)
+{
+	wake_philo(data, (i + data->nb_philos - 1) % data->nb_philos);
+	wake_philo(data, (i + 1) % data->nb_philos);
+}
+
+void	drop_fork_pair(t_philo *philo)
+{
+	uint64_t	*bits;
+	int			left;
+	int			right;
+
+	bits = philo->data->fork_bits;
+	left = philo->id - 1;
+	right = philo->id % philo->data->nb_philos;
+	if (left / 64 == right / 64)
+		__atomic_fetch_and(&bits[left / 64],
+			~((1ULL << (left % 64)) | (1ULL << (right % 64))),
+			__ATOMIC_RELEASE);
+	else
+	{
+		__atomic_fetch_and(&bits[left / 64], ~(1ULL << (left % 64)),
+			__ATOMIC_RELEASE);
+		__atomic_fetch_and(&bits[right / 64], ~(1ULL << (right % 64)),
+			__ATOMIC_RELEASE);
+	}
+	wake_neighbours(philo->data, left);
+}
+
+void	stop_fork_wait(t_philo *philo)
+{
+	__atomic_store_n(&philo->waiting, 0, __ATOMIC_RELEASE);
+	wake_neighbours(philo->data, philo->id - 1);
+}
+
+void	wake_fork_waiters(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (data->fork_events && i <= data->nb_philos / 64)
+	{
+		__atomic_add_fetch(&data->fork_events[i], 1, __ATOMIC_RELEASE);
+		futex_wake(&data->fork_events[i]);
+		i++;
+	}
+}
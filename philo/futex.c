@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   futex.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:10:27 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:27:04 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	futex_wait(int *addr, int val, long timeout_us)
+{
+	struct timespec	timeout;
+
+	timeout.tv_sec = timeout_us / 1000000;
+	timeout.tv_nsec = timeout_us % 1000000 * 1000;
+	return (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, &timeout,
+			NULL, 0));
+}
+
+void	futex_wake(int *addr)
+{
+	syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+int	futex_wait_bits(int *addr, int val, unsigned int bits)
+{
+	return (syscall(SYS_futex, addr, FUTEX_WAIT_BITSET_PRIVATE, val, NULL,
+			NULL, bits));
+}
+
+void	futex_wake_bits(int *addr, unsigned int bits)
+{
+	syscall(SYS_futex, addr, FUTEX_WAKE_BITSET_PRIVATE, INT_MAX, NULL, NULL,
+		bits);
+}
@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/26 09:01:13 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/21 17:14:09 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:27:04 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,8 +23,9 @@ int	create_philo_threads(t_data *data)
 				&data->philos[i]) != 0)
 		{
 			printf("error invalid pthread_create");
-			data->someone_died = 1;
-			free_data(data);
+			stop_simulation(data);
+			while (i-- > 0)
+				pthread_join(data->philos[i].thread, NULL);
 			return (1);
 		}
 		i++;
@@ -32,6 +33,31 @@ int	create_philo_threads(t_data *data)
 	return (0);
 }
 
+int	create_output_thread(t_data *data)
+{
+	if (pthread_create(&data->out.thread, NULL, output_routine, data) != 0)
+	{
+		printf("error invalid pthread_create");
+		return (1);
+	}
+	data->out.running = 1;
+	return (0);
+}
+
+static void	free_init(t_data *data)
+{
+	free(data->sched.order);
+	free(data->monitors);
+	free(data->forks);
+	free(data->fork_bits);
+	free(data->fork_events);
+	free(data->deadlines);
+	free(data->philos);
+	free_output(data);
+	pthread_mutex_destroy(&data->print_mutex);
+	free(data);
+}
+
 t_data	*init(t_data *data, int argc, char **argv)
 {
 	data = malloc(sizeof(t_data));
@@ -42,13 +68,12 @@ t_data	*init(t_data *data, int argc, char **argv)
 		free(data);
 		return (NULL);
 	}
-	if (init_philos(data) != 0)
+	data->monitors = NULL;
+	data->sched.order = NULL;
+	if (init_philos(data) != 0 || init_monitors(data) != 0
+		|| init_sched(data) != 0)
 	{
-		free(data->forks);
-		free(data->philos);
-		pthread_mutex_destroy(&data->print_mutex);
-		pthread_mutex_destroy(&data->death_mutex);
-		free(data);
+		free_init(data);
 		return (NULL);
 	}
 	return (data);
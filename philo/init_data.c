@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/21 17:02:49 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/21 17:19:25 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:20:33 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,7 +23,7 @@ static int	validate_params(char **argv)
 	tdie = ft_atoi(argv[2]);
 	teat = ft_atoi(argv[3]);
 	tsleep = ft_atoi(argv[4]);
-	if (nb <= 0 || nb > 200 || tdie <= 0 || tdie > 10000 || teat <= 0
+	if (nb <= 0 || nb > PHILO_MAX || tdie <= 0 || tdie > 10000 || teat <= 0
 		|| teat > 10000 || tsleep <= 0 || tsleep > 10000)
 	{
 		printf("invalid");
@@ -43,18 +43,44 @@ static void	set_data_values(t_data *data, int argc, char **argv)
 	else
 		data->max_meals = -1;
 	data->someone_died = 0;
+	data->perf_on = (getenv("PHILO_PERF") != NULL);
 	data->start_time = get_current_time();
 }
 
-static int	init_mutexes(t_data *data)
+static void	select_backend(t_output *out)
 {
-	if (pthread_mutex_init(&data->print_mutex, NULL) != 0)
-		return (1);
-	if (pthread_mutex_init(&data->death_mutex, NULL) != 0)
+	const char	*mode;
+
+	out->ring.fd = -1;
+	mode = getenv("PHILO_OUTPUT");
+	if (mode && ft_strcmp(mode, "stdio") == 0)
+		out->stdio = 1;
+	else if (!mode || ft_strcmp(mode, "writev") != 0)
+		uring_init(out);
+}
+
+static int	init_output(t_data *data)
+{
+	int	i;
+	int	failed;
+
+	memset(&data->out, 0, sizeof(t_output));
+	data->out.cap = OUT_LINE_MAX * OUT_LINES_PER_PHILO * data->nb_philos;
+	failed = 0;
+	i = 0;
+	while (i < OUT_BUFFERS)
 	{
-		pthread_mutex_destroy(&data->print_mutex);
+		data->out.bufs[i] = malloc(data->out.cap);
+		failed |= !data->out.bufs[i++];
+	}
+	if (failed || pthread_cond_init(&data->out.drained, NULL) != 0)
+	{
+		i = 0;
+		while (i < OUT_BUFFERS)
+			free(data->out.bufs[i++]);
 		return (1);
 	}
+	select_backend(&data->out);
 	return (0);
 }
 
@@ -63,5 +89,12 @@ int	init_data(t_data *data, int argc, char **argv)
 	if (validate_params(argv))
 		return (1);
 	set_data_values(data, argc, argv);
-	return (init_mutexes(data));
+	if (pthread_mutex_init(&data->print_mutex, NULL) != 0)
+		return (1);
+	if (init_output(data))
+	{
+		pthread_mutex_destroy(&data->print_mutex);
+		return (1);
+	}
+	return (0);
 }
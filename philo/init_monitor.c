@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_monitor.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:25:44 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:13:04 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	count_monitors(int nb_philos)
+{
+	int	cores;
+	int	count;
+
+	cores = count_cpus();
+	count = (nb_philos + PHILOS_PER_MONITOR - 1) / PHILOS_PER_MONITOR;
+	if (count > cores)
+		count = cores;
+	if (count > MAX_MONITORS)
+		count = MAX_MONITORS;
+	if (count < 1)
+		count = 1;
+	return (count);
+}
+
+static void	set_monitor_values(t_data *data, int i)
+{
+	int	share;
+	int	extra;
+	int	j;
+
+	share = data->nb_philos / data->nb_monitors;
+	extra = data->nb_philos % data->nb_monitors;
+	data->monitors[i].first = i * share;
+	if (i < extra)
+		data->monitors[i].first += i;
+	else
+		data->monitors[i].first += extra;
+	data->monitors[i].end = data->monitors[i].first + share;
+	if (i < extra)
+		data->monitors[i].end++;
+	data->monitors[i].data = data;
+	data->monitors[i].pinned = 0;
+	CPU_ZERO(&data->monitors[i].cpus);
+	j = data->monitors[i].first;
+	while (j < data->monitors[i].end)
+		data->philos[j++].shard = i;
+}
+
+int	init_monitors(t_data *data)
+{
+	int	i;
+
+	data->nb_monitors = count_monitors(data->nb_philos);
+	data->monitors_done = 0;
+	data->scan_deadlines = select_deadline_scan();
+	data->monitors = malloc(sizeof(t_monitor) * data->nb_monitors);
+	if (!data->monitors)
+		return (1);
+	i = 0;
+	while (i < data->nb_monitors)
+	{
+		set_monitor_values(data, i);
+		i++;
+	}
+	assign_shard_cpus(data);
+	return (0);
+}
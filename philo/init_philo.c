@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/21 17:03:12 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/21 17:14:25 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:46:23 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,10 +14,29 @@
 
 static int	allocate_resources(t_data *data)
 {
-	data->forks = malloc(sizeof(pthread_mutex_t) * data->nb_philos);
+	int	i;
+
+	data->forks = NULL;
+	data->fork_bits = NULL;
+	data->fork_events = NULL;
 	data->philos = malloc(sizeof(t_philo) * data->nb_philos);
-	if (!data->forks || !data->philos)
+	data->deadlines = malloc(sizeof(long) * data->nb_philos);
+	if (FORK_BITMASK)
+	{
+		data->fork_bits = malloc(sizeof(uint64_t) * (data->nb_philos / 64 + 1));
+		data->fork_events = malloc(sizeof(int) * (data->nb_philos / 64 + 1));
+	}
+	else
+		data->forks = malloc(sizeof(pthread_mutex_t) * data->nb_philos);
+	if (!data->philos || !data->deadlines
+		|| (!data->forks && (!data->fork_bits || !data->fork_events)))
 		return (1);
+	i = 0;
+	while (data->fork_bits && i <= data->nb_philos / 64)
+	{
+		data->fork_bits[i] = 0;
+		data->fork_events[i++] = 0;
+	}
 	return (0);
 }
 
@@ -26,7 +45,7 @@ static int	init_forks(t_data *data)
 	int	i;
 
 	i = 0;
-	while (i < data->nb_philos)
+	while (!FORK_BITMASK && i < data->nb_philos)
 	{
 		if (pthread_mutex_init(&data->forks[i], NULL) != 0)
 			return (1);
@@ -38,10 +57,21 @@ static int	init_forks(t_data *data)
 static void	set_philo_values(t_data *data, int i)
 {
 	data->philos[i].id = i + 1;
-	data->philos[i].last_meal = data->start_time;
+	data->philos[i].time_to_die = data->time_to_die;
+	data->philos[i].time_to_eat = data->time_to_eat;
+	data->philos[i].time_to_sleep = data->time_to_sleep;
 	data->philos[i].meals_eaten = 0;
-	data->philos[i].left_fork = &data->forks[i];
-	data->philos[i].right_fork = &data->forks[(i + 1) % data->nb_philos];
+	data->philos[i].waiting = 0;
+	data->philos[i].left_fork = NULL;
+	data->philos[i].right_fork = NULL;
+	if (!FORK_BITMASK)
+	{
+		data->philos[i].left_fork = &data->forks[i];
+		data->philos[i].right_fork = &data->forks[(i + 1) % data->nb_philos];
+	}
+	data->philos[i].trace.grants = NULL;
+	data->philos[i].trace.len = 0;
+	data->philos[i].trace.cap = 0;
 	data->philos[i].data = data;
 }
 
@@ -66,5 +96,7 @@ int	init_philos(t_data *data)
 		return (1);
 	if (init_forks(data))
 		return (1);
-	return (init_philo_mutexes(data));
+	if (init_philo_mutexes(data))
+		return (1);
+	return (init_timings(data));
 }
@@ -0,0 +1,16 @@
+#!/bin/bash
+# Usage: ./latency.sh <nb_philos> [time_to_die]
+# Everyone eats once and then sleeps past time_to_die. The gap between the
+# victim's deadline (last meal + time_to_die) and the printed death is the
+# monitor's detection latency.
+
+n=$1
+die=${2:-4000}
+./philo "$n" "$die" 100 $((die + 2000)) | awk -v n="$n" -v die="$die" '
+	$3 == "is" && $4 == "eating" { meal[$2] = $1 }
+	$3 == "died" {
+		printf "%6d philosophers  died at %5d ms  latency %4d ms\n",
+			n, $1, $1 - meal[$2] - die
+		found = 1
+	}
+	END { if (!found) { print n " philosophers: no death reported"; exit 1 } }'
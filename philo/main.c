@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/24 18:08:42 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/21 16:06:41 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:27:04 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,14 +21,20 @@ void	free_data(t_data *data)
 	i = 0;
 	while (i < data->nb_philos)
 	{
-		pthread_mutex_destroy(&data->forks[i]);
+		if (data->forks)
+			pthread_mutex_destroy(&data->forks[i]);
 		pthread_mutex_destroy(&data->philos[i].meal_mutex);
 		i++;
 	}
 	pthread_mutex_destroy(&data->print_mutex);
-	pthread_mutex_destroy(&data->death_mutex);
+	free_output(data);
+	free_sched(data);
+	free(data->monitors);
+	free(data->deadlines);
 	if (data->forks)
 		free(data->forks);
+	free(data->fork_bits);
+	free(data->fork_events);
 	if (data->philos)
 		free(data->philos);
 	if (data)
@@ -38,23 +44,32 @@ void	free_data(t_data *data)
 void	one_philo_case(t_data *data)
 {
 	printf("0 1 has taken a fork\n");
-	usleep(data->time_to_die * 1000);
-	printf("%d 1 died\n", data->time_to_die);
+	usleep(data->philos[0].time_to_die * 1000);
+	printf("%d 1 died\n", data->philos[0].time_to_die);
 	free_data(data);
 }
 
-static int	create_monitor_thread(t_data *data, pthread_t *monitor)
+static int	create_monitor_threads(t_data *data)
 {
-	if (pthread_create(monitor, NULL, monitor_routine, data) != 0)
+	int	i;
+
+	i = 0;
+	while (i < data->nb_monitors)
 	{
-		printf("error invalid pthread_create");
-		free_data(data);
-		return (1);
+		if (pthread_create(&data->monitors[i].thread, NULL, monitor_routine,
+				&data->monitors[i]) != 0)
+		{
+			printf("error invalid pthread_create");
+			stop_simulation(data);
+			data->nb_monitors = i;
+			return (1);
+		}
+		i++;
 	}
 	return (0);
 }
 
-static void	wait_all_threads(t_data *data, pthread_t monitor)
+static void	wait_all_threads(t_data *data)
 {
 	int	i;
 
@@ -64,24 +79,33 @@ static void	wait_all_threads(t_data *data, pthread_t monitor)
 		pthread_join(data->philos[i].thread, NULL);
 		i++;
 	}
-	pthread_join(monitor, NULL);
+	i = 0;
+	while (i < data->nb_monitors)
+	{
+		pthread_join(data->monitors[i].thread, NULL);
+		i++;
+	}
+	finish_output(data);
 }
 
 int	main(int argc, char **argv)
 {
 	t_data		*data;
-	pthread_t	monitor;
 
 	data = NULL;
 	if (validate_and_init(argc, argv, &data))
 		return (1);
 	if (data->nb_philos == 1)
 		return (one_philo_case(data), 0);
-	if (create_philo_threads(data))
+	if (create_output_thread(data))
 		return (free_data(data), 1);
-	if (create_monitor_thread(data, &monitor))
-		return (1);
-	wait_all_threads(data, monitor);
+	if (create_philo_threads(data))
+		return (finish_output(data), free_data(data), 1);
+	if (create_monitor_threads(data))
+		return (wait_all_threads(data), free_data(data), 1);
+	wait_all_threads(data);
+	perf_report(data);
+	save_schedule(data);
 	free_data(data);
 	return (0);
 }
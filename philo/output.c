@@ -0,0 +1,92 @@
+#include "philo.h"
+
+static size_t	put_nbr(char *dst, long n)
+{
+	char	tmp[20];
+	size_t	len;
+	size_t	i;
+
+	len = 0;
+	if (n == 0)
+		tmp[len++] = '0';
+	while (n > 0)
+	{
+		tmp[len++] = '0' + n % 10;
+		n /= 10;
+	}
+	i = 0;
+	while (i < len)
+	{
+		dst[i] = tmp[len - 1 - i];
+		i++;
+	}
+	return (len);
+}
+
+static int	reserve_line(t_data *data)
+{
+	t_output	*out;
+	int			head;
+
+	out = &data->out;
+	head = (out->tail + out->queued) % OUT_BUFFERS;
+	while (out->lens[head] + OUT_LINE_MAX > out->cap)
+	{
+		if (out->queued < OUT_BUFFERS - 1)
+			out->queued++;
+		else
+			pthread_cond_wait(&out->drained, &data->print_mutex);
+		head = (out->tail + out->queued) % OUT_BUFFERS;
+	}
+	return (head);
+}
+
+void	output_line(t_data *data, long timestamp, int id, const char *msg)
+{
+	t_output	*out;
+	char		*buf;
+	size_t		len;
+	int			head;
+
+	out = &data->out;
+	if (out->stdio)
+		return ((void)printf("%ld %d %s\n", timestamp, id, msg));
+	head = reserve_line(data);
+	buf = out->bufs[head];
+	len = out->lens[head];
+	len += put_nbr(buf + len, timestamp);
+	buf[len++] = ' ';
+	len += put_nbr(buf + len, id);
+	buf[len++] = ' ';
+	while (*msg)
+		buf[len++] = *msg++;
+	buf[len++] = '\n';
+	out->lens[head] = len;
+}
+
+void	*output_routine(void *arg)
+{
+	t_data	*data;
+	int		over;
+
+	data = (t_data *)arg;
+	over = 0;
+	while (!over)
+	{
+		over = is_stopped(data);
+		flush_output(data);
+		usleep(OUT_FLUSH_US);
+	}
+	return (NULL);
+}
+
+void	free_output(t_data *data)
+{
+	int	i;
+
+	uring_free(&data->out.ring);
+	pthread_cond_destroy(&data->out.drained);
+	i = 0;
+	while (i < OUT_BUFFERS)
+		free(data->out.bufs[i++]);
+}
@@ -0,0 +1,34 @@
+#!/bin/bash
+# Usage: ./output_bench.sh <philo arguments...>
+# Runs the table once per output backend (PHILO_OUTPUT=uring, writev, stdio)
+# and per sink: a file, a pipe, a slow pipe whose reader only starts after
+# SLOW_START seconds, and /dev/null. Prints the wall and CPU time of philo,
+# the lines written and the deaths reported for each run.
+
+SLOW_START=${SLOW_START:-2}
+TIMEFORMAT='%R %U %S'
+count='{ n++ } / died$/ { d++ } END { print n + 0, d + 0 }'
+
+run() {
+	case $1 in
+	file) { time ./philo "${@:2}" > bench.out; } 2> bench.time
+		awk "$count" bench.out ;;
+	pipe) { time ./philo "${@:2}"; } 2> bench.time | awk "$count" ;;
+	slowpipe) { time ./philo "${@:2}"; } 2> bench.time \
+		| { sleep "$SLOW_START"; awk "$count"; } ;;
+	null) { time ./philo "${@:2}" > /dev/null; } 2> bench.time
+		echo "- -" ;;
+	esac
+}
+
+for mode in uring writev stdio; do
+	for sink in file pipe slowpipe null; do
+		read -r lines deaths < <(PHILO_OUTPUT=$mode run "$sink" "$@")
+		read -r real user sys < bench.time
+		awk -v m="$mode" -v s="$sink" -v l="$lines" -v d="$deaths" \
+			-v r="$real" -v u="$user" -v k="$sys" 'BEGIN { printf \
+			"%-7s %-9s %7s lines %2s died %6.2fs real %6.2fs cpu\n", \
+			m, s, l, d, r, u + k }'
+	done
+done
+rm -f bench.out bench.time
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_io.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:15:48 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:15:48 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	write_iov(struct iovec *iov, int count)
+{
+	ssize_t	ret;
+
+	while (count > 0)
+	{
+		ret = writev(STDOUT_FILENO, iov, count);
+		if (ret < 0 && errno == EINTR)
+			continue ;
+		if (ret <= 0)
+			return ;
+		while (count > 0 && (size_t)ret >= iov->iov_len)
+		{
+			ret -= iov->iov_len;
+			iov++;
+			count--;
+		}
+		if (count > 0)
+		{
+			iov->iov_base = (char *)iov->iov_base + ret;
+			iov->iov_len -= ret;
+		}
+	}
+}
+
+static void	write_batch(t_output *out, int count)
+{
+	struct iovec	iov[OUT_BUFFERS];
+	size_t			done[OUT_BUFFERS];
+	int				slot;
+	int				k;
+
+	k = 0;
+	while (k < count)
+		done[k++] = 0;
+	if (out->ring.fd >= 0)
+		uring_write(out, count, done);
+	k = 0;
+	while (k < count)
+	{
+		slot = (out->tail + k) % OUT_BUFFERS;
+		iov[k].iov_base = out->bufs[slot] + done[k];
+		iov[k].iov_len = out->lens[slot] - done[k];
+		k++;
+	}
+	write_iov(iov, count);
+}
+
+void	flush_output(t_data *data)
+{
+	t_output	*out;
+	int			count;
+	int			k;
+
+	out = &data->out;
+	pthread_mutex_lock(&data->print_mutex);
+	if (out->queued < OUT_BUFFERS - 1
+		&& out->lens[(out->tail + out->queued) % OUT_BUFFERS] > 0)
+		out->queued++;
+	count = out->queued;
+	pthread_mutex_unlock(&data->print_mutex);
+	write_batch(out, count);
+	pthread_mutex_lock(&data->print_mutex);
+	k = 0;
+	while (k < count)
+		out->lens[(out->tail + k++) % OUT_BUFFERS] = 0;
+	out->tail = (out->tail + count) % OUT_BUFFERS;
+	out->queued -= count;
+	pthread_cond_broadcast(&out->drained);
+	pthread_mutex_unlock(&data->print_mutex);
+}
+
+void	finish_output(t_data *data)
+{
+	if (data->out.running)
+		pthread_join(data->out.thread, NULL);
+	while (data->out.queued > 0 || data->out.lens[data->out.tail] > 0)
+		flush_output(data);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:47:53 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:29:42 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	open_counter(int i)
+{
+	static const unsigned int		types[PERF_COUNTERS] = {
+		PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+		PERF_TYPE_SOFTWARE, PERF_TYPE_SOFTWARE};
+	static const unsigned long long	configs[PERF_COUNTERS] = {
+		PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_SW_CONTEXT_SWITCHES,
+		PERF_COUNT_SW_CPU_MIGRATIONS};
+	static const struct perf_event_attr	zero;
+	struct perf_event_attr				attr;
+	int									fd;
+
+	attr = zero;
+	attr.type = types[i];
+	attr.size = sizeof(attr);
+	attr.config = configs[i];
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+		| PERF_FORMAT_TOTAL_TIME_RUNNING;
+	fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if (fd < 0 && (errno == EACCES || errno == EPERM))
+	{
+		attr.exclude_kernel = 1;
+		fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	}
+	return (fd);
+}
+
+static long long	read_counter(int fd, int *scaled)
+{
+	unsigned long long	values[3];
+
+	*scaled = 0;
+	if (read(fd, values, sizeof(values)) != sizeof(values) || values[2] == 0)
+		return (-1);
+	if (values[2] >= values[1])
+		return (values[0]);
+	*scaled = 1;
+	return ((long double)values[0] * values[1] / values[2]);
+}
+
+void	perf_start(t_data *data, t_perf *perf)
+{
+	int	i;
+
+	perf->scaled = 0;
+	i = 0;
+	while (i < PERF_COUNTERS)
+	{
+		perf->fds[i] = -1;
+		perf->counts[i] = -1;
+		if (data->perf_on)
+			perf->fds[i] = open_counter(i);
+		i++;
+	}
+}
+
+void	perf_stop(t_data *data, t_perf *perf)
+{
+	struct rusage	usage;
+	int				scaled;
+	int				i;
+
+	if (!data->perf_on)
+		return ;
+	i = 0;
+	while (i < PERF_COUNTERS)
+	{
+		if (perf->fds[i] >= 0)
+		{
+			perf->counts[i] = read_counter(perf->fds[i], &scaled);
+			perf->scaled |= scaled << i;
+			close(perf->fds[i]);
+		}
+		i++;
+	}
+	getrusage(RUSAGE_THREAD, &usage);
+	perf->user_us = usage.ru_utime.tv_sec * 1000000 + usage.ru_utime.tv_usec;
+	perf->sys_us = usage.ru_stime.tv_sec * 1000000 + usage.ru_stime.tv_usec;
+	perf->vol_cs = usage.ru_nvcsw;
+	perf->invol_cs = usage.ru_nivcsw;
+}
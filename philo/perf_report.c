@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf_report.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:47:53 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:29:42 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	print_count(long long value, int scaled)
+{
+	if (value < 0)
+		dprintf(STDERR_FILENO, " %13s", "n/a");
+	else if (scaled)
+		dprintf(STDERR_FILENO, " %12lld*", value);
+	else
+		dprintf(STDERR_FILENO, " %13lld", value);
+}
+
+static void	print_row(const char *label, int id, t_perf *perf)
+{
+	int	i;
+
+	if (id > 0)
+		dprintf(STDERR_FILENO, "%-8s %5d", label, id);
+	else
+		dprintf(STDERR_FILENO, "%-14s", label);
+	i = 0;
+	while (i < PERF_COUNTERS)
+	{
+		print_count(perf->counts[i], perf->scaled >> i & 1);
+		i++;
+	}
+	dprintf(STDERR_FILENO, " %9ld %9ld %7ld %7ld\n", perf->user_us / 1000,
+		perf->sys_us / 1000, perf->vol_cs, perf->invol_cs);
+}
+
+static void	add_perf(t_perf *total, t_perf *perf)
+{
+	int	i;
+
+	i = 0;
+	while (i < PERF_COUNTERS)
+	{
+		if (perf->counts[i] >= 0 && total->counts[i] < 0)
+			total->counts[i] = 0;
+		if (perf->counts[i] >= 0)
+			total->counts[i] += perf->counts[i];
+		i++;
+	}
+	total->scaled |= perf->scaled;
+	total->user_us += perf->user_us;
+	total->sys_us += perf->sys_us;
+	total->vol_cs += perf->vol_cs;
+	total->invol_cs += perf->invol_cs;
+}
+
+static void	print_header(t_perf *total)
+{
+	int	i;
+
+	dprintf(STDERR_FILENO, "%-14s %13s %13s %13s %13s %13s %9s %9s %7s %7s\n",
+		"thread", "cycles", "instructions", "cache-misses", "ctx-switches",
+		"migrations", "user_ms", "sys_ms", "vcsw", "ivcsw");
+	i = 0;
+	while (i < PERF_COUNTERS)
+		total->counts[i++] = -1;
+	total->scaled = 0;
+	total->user_us = 0;
+	total->sys_us = 0;
+	total->vol_cs = 0;
+	total->invol_cs = 0;
+}
+
+void	perf_report(t_data *data)
+{
+	t_perf	total;
+	int		i;
+
+	if (!data->perf_on)
+		return ;
+	print_header(&total);
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		print_row("philo", data->philos[i].id, &data->philos[i].perf);
+		add_perf(&total, &data->philos[i].perf);
+		i++;
+	}
+	i = 0;
+	while (i < data->nb_monitors)
+	{
+		print_row("monitor", i + 1, &data->monitors[i].perf);
+		add_perf(&total, &data->monitors[i].perf);
+		i++;
+	}
+	print_row("total", 0, &total);
+	if (total.scaled)
+		dprintf(STDERR_FILENO, "* multiplexed counter, scaled by "
+			"time_enabled / time_running\n");
+}
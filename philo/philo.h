@@ -6,12 +6,15 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/24 18:07:53 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/22 19:40:16 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:59:50 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PHILO_H
 # define PHILO_H
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
 # include <unistd.h>
 # include <stdio.h>
 # include <pthread.h>
@@ -19,21 +22,162 @@
 # include <sys/time.h>
 # include <errno.h>
 # include <limits.h>
+# include <time.h>
+# include <fcntl.h>
+# include <string.h>
+# include <stdint.h>
+# include <sched.h>
+# include <sys/resource.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/uio.h>
+# include <sys/syscall.h>
+# include <linux/futex.h>
+# include <linux/io_uring.h>
+# include <linux/perf_event.h>
+
+# ifndef PHILO_MAX
+#  define PHILO_MAX 200
+# endif
+# ifndef PHILOS_PER_MONITOR
+#  define PHILOS_PER_MONITOR 64
+# endif
+# ifndef SCAN_SIMD
+#  define SCAN_SIMD 1
+# endif
+
+# ifndef FORK_BITMASK
+#  define FORK_BITMASK 0
+# endif
+# ifndef MAX_MONITORS
+#  define MAX_MONITORS 64
+# endif
+# define OUT_LINE_MAX 64
+# define OUT_LINES_PER_PHILO 4
+# define OUT_BUFFERS 4
+# define OUT_FLUSH_US 500
+# define FORK_WAIT_US 500
+# define SCHED_OFF 0
+# define SCHED_RECORD 1
+# define SCHED_REPLAY 2
+# define TRACE_CHUNK 256
+# define SCHED_MAGIC 0x43534850
+# define SCHED_VERSION 2
+# define REPLAY_POLL_US 50
+# define PERF_COUNTERS 5
+# define READ_CHUNK 4096
 
 typedef struct s_data	t_data;
+typedef long			(*t_scan)(long *deadlines, int n);
+
+typedef struct s_uring
+{
+	int					fd;
+	unsigned int		entries;
+	unsigned int		*sq_tail;
+	unsigned int		*sq_mask;
+	unsigned int		*sq_array;
+	unsigned int		*cq_head;
+	unsigned int		*cq_tail;
+	unsigned int		*cq_mask;
+	struct io_uring_sqe	*sqes;
+	struct io_uring_cqe	*cqes;
+	void				*rings;
+	size_t				rings_size;
+}	t_uring;
+
+typedef struct s_output
+{
+	char			*bufs[OUT_BUFFERS];
+	size_t			lens[OUT_BUFFERS];
+	size_t			cap;
+	int				tail;
+	int				queued;
+	int				stdio;
+	int				running;
+	pthread_t		thread;
+	pthread_cond_t	drained;
+	t_uring			ring;
+}	t_output;
+
+typedef struct s_grant
+{
+	int				seq;
+	int				philo;
+	int				fork;
+}	t_grant;
+
+typedef struct s_trace
+{
+	t_grant			*grants;
+	int				len;
+	int				cap;
+}	t_trace;
+
+typedef struct s_sched
+{
+	int				mode;
+	int				seq;
+	int				len;
+	int				failed;
+	char			*path;
+	t_grant			*order;
+}	t_sched;
+
+typedef struct s_sched_header
+{
+	int				magic;
+	int				version;
+	int				forks;
+	int				nb_philos;
+	int				time_to_die;
+	int				time_to_eat;
+	int				time_to_sleep;
+	int				max_meals;
+	unsigned int	timings;
+	int				len;
+}	t_sched_header;
+
+typedef struct s_perf
+{
+	int				fds[PERF_COUNTERS];
+	long long		counts[PERF_COUNTERS];
+	int				scaled;
+	long			user_us;
+	long			sys_us;
+	long			vol_cs;
+	long			invol_cs;
+}	t_perf;
 
 typedef struct s_philo
 {
 	int				id;
-	long long		last_meal;
+	int				time_to_die;
+	int				time_to_eat;
+	int				time_to_sleep;
 	int				meals_eaten;
+	int				waiting;
 	pthread_t		thread;
 	pthread_mutex_t	*left_fork;
 	pthread_mutex_t	*right_fork;
 	pthread_mutex_t	meal_mutex;
+	int				shard;
+	t_trace			trace;
+	t_perf			perf;
 	t_data			*data;
 }	t_philo;
 
+typedef struct s_monitor
+{
+	int				first;
+	int				end;
+	int				pinned;
+	cpu_set_t		cpus;
+	pthread_t		thread;
+	t_perf			perf;
+	t_data			*data;
+}	t_monitor;
+
 struct s_data
 {
 	int				nb_philos;
@@ -42,24 +186,65 @@ struct s_data
 	int				time_to_sleep;
 	int				max_meals;
 	int				someone_died;
+	int				perf_on;
+	int				nb_monitors;
+	int				monitors_done;
 	long			start_time;
 	pthread_mutex_t	*forks;
+	uint64_t		*fork_bits;
+	int				*fork_events;
+	long			*deadlines;
+	t_scan			scan_deadlines;
 	pthread_mutex_t	print_mutex;
-	pthread_mutex_t	death_mutex;
+	t_output		out;
+	t_sched			sched;
 	t_philo			*philos;
+	t_monitor		*monitors;
 };
 
+// affinity.c
+int			count_cpus(void);
+void		assign_shard_cpus(t_data *data);
+void		pin_to_shard(t_monitor *mon);
+
 // check.c
 int			validate_and_init(int argc, char **argv, t_data **data);
 
 // init_data.c
 int			init_data(t_data *data, int argc, char **argv);
 
+// init_monitor.c
+int			init_monitors(t_data *data);
+
 // init_philo.c
 int			init_philos(t_data *data);
 
+// deadline_scan.c
+long		min_deadline_scalar(long *deadlines, int n);
+int			first_expired(long *deadlines, int n, long now);
+void		set_deadline(t_philo *philo, long deadline);
+long		get_deadline(t_data *data, int i);
+
+// deadline_simd.c
+t_scan		select_deadline_scan(void);
+
+// forks_bitmask.c
+int			take_fork_pair(t_philo *philo);
+
+// forks_wait.c
+void		drop_fork_pair(t_philo *philo);
+void		stop_fork_wait(t_philo *philo);
+void		wake_fork_waiters(t_data *data);
+
+// futex.c
+int			futex_wait(int *addr, int val, long timeout_us);
+void		futex_wake(int *addr);
+int			futex_wait_bits(int *addr, int val, unsigned int bits);
+void		futex_wake_bits(int *addr, unsigned int bits);
+
 // init.c
 int			create_philo_threads(t_data *data);
+int			create_output_thread(t_data *data);
 t_data		*init(t_data *data, int argc, char **argv);
 
 // main.c
@@ -69,16 +254,33 @@ void		free_data(t_data *data);
 // monitor.c
 void		*monitor_routine(void *arg);
 
+// output.c
+void		output_line(t_data *data, long timestamp, int id, const char *msg);
+void		*output_routine(void *arg);
+void		free_output(t_data *data);
+
+// output_io.c
+void		flush_output(t_data *data);
+void		finish_output(t_data *data);
+
+// perf.c
+void		perf_start(t_data *data, t_perf *perf);
+void		perf_stop(t_data *data, t_perf *perf);
+
+// perf_report.c
+void		perf_report(t_data *data);
+
 // routine_actions.c
 void		philo_think(t_philo *philo);
 void		philo_eat(t_philo *philo);
 void		philo_sleep(t_philo *philo);
-void		take_forks(t_philo *philo);
+int			take_forks(t_philo *philo);
 void		drop_forks(t_philo *philo);
 
 // routine_time.c
 void		precise_sleep(t_philo *philo, long duration);
 void		initial_delay(t_philo *philo);
+int			take_fork(t_philo *philo, pthread_mutex_t *fork);
 
 // routine.c
 void		print_action_ts(t_philo *philo, const char *msg);
@@ -86,6 +288,41 @@ void		update_meal_info(t_philo *philo);
 int			check_death_during_sleep(t_philo *philo);
 void		*routine(void *arg);
 
+// sched.c
+int			wait_grant_turn(t_philo *philo, int fork);
+void		record_grant(t_philo *philo, int fork);
+void		free_sched(t_data *data);
+
+// sched_header.c
+void		fill_header(t_data *data, t_sched_header *head, int len);
+int			check_header(t_data *data, t_sched_header *head, off_t size);
+
+// sched_io.c
+int			init_sched(t_data *data);
+void		save_schedule(t_data *data);
+
+// sched_load.c
+int			load_schedule(t_data *data);
+
+// stop.c
+int			is_stopped(t_data *data);
+int			claim_stop(t_data *data);
+void		wake_sleepers(t_data *data);
+void		stop_simulation(t_data *data);
+
+// timings.c
+int			init_timings(t_data *data);
+
+// read_file.c
+char		*read_file(const char *path);
+
+// uring.c
+void		uring_write(t_output *out, int count, size_t *done);
+
+// uring_setup.c
+void		uring_init(t_output *out);
+void		uring_free(t_uring *ring);
+
 // utils.c
 int			ft_atoi(const char *nptr);
 long		get_current_time(void);
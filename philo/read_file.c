@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   read_file.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:31:40 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:31:40 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static char	*grow_text(char *text, size_t len, size_t *cap)
+{
+	char	*bigger;
+	size_t	i;
+
+	bigger = malloc(*cap * 2 + 1);
+	if (bigger)
+	{
+		i = 0;
+		while (i < len)
+		{
+			bigger[i] = text[i];
+			i++;
+		}
+		*cap *= 2;
+	}
+	free(text);
+	return (bigger);
+}
+
+static char	*read_all(int fd)
+{
+	char	*text;
+	size_t	len;
+	size_t	cap;
+	ssize_t	ret;
+
+	cap = READ_CHUNK;
+	text = malloc(cap + 1);
+	len = 0;
+	ret = 1;
+	while (text && ret > 0)
+	{
+		if (len == cap)
+			text = grow_text(text, len, &cap);
+		ret = -1;
+		if (text)
+			ret = read(fd, text + len, cap - len);
+		if (ret > 0)
+			len += ret;
+	}
+	if (text && ret < 0)
+		return (free(text), NULL);
+	if (text)
+		text[len] = '\0';
+	return (text);
+}
+
+char	*read_file(const char *path)
+{
+	char	*text;
+	int		fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	text = read_all(fd);
+	close(fd);
+	return (text);
+}
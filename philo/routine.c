@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/26 09:00:23 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/22 20:01:23 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:13:04 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,53 +18,39 @@ void	print_action_ts(t_philo *philo, const char *msg)
 	long	timestamp;
 
 	data = philo->data;
-	pthread_mutex_lock(&data->death_mutex);
-	if (!data->someone_died)
+	pthread_mutex_lock(&data->print_mutex);
+	if (!is_stopped(data))
 	{
-		pthread_mutex_lock(&data->print_mutex);
 		timestamp = get_current_time() - data->start_time;
-		printf("%ld %d %s\n", timestamp, philo->id, msg);
-		pthread_mutex_unlock(&data->print_mutex);
+		output_line(data, timestamp, philo->id, msg);
 	}
-	pthread_mutex_unlock(&data->death_mutex);
+	pthread_mutex_unlock(&data->print_mutex);
 }
 
 void	update_meal_info(t_philo *philo)
 {
-	t_data	*data;
+	long	deadline;
 
-	data = philo->data;
 	pthread_mutex_lock(&philo->meal_mutex);
-	philo->last_meal = get_current_time();
 	philo->meals_eaten++;
+	deadline = get_current_time() + philo->time_to_die;
+	if (philo->data->max_meals > 0
+		&& philo->meals_eaten >= philo->data->max_meals)
+		deadline = LONG_MAX;
 	pthread_mutex_unlock(&philo->meal_mutex);
+	set_deadline(philo, deadline);
 	print_action_ts(philo, "is eating");
 }
 
 int	check_death_during_sleep(t_philo *philo)
 {
-	t_data	*data;
-
-	data = philo->data;
-	pthread_mutex_lock(&data->death_mutex);
-	if (data->someone_died)
-	{
-		pthread_mutex_unlock(&data->death_mutex);
-		return (1);
-	}
-	pthread_mutex_unlock(&data->death_mutex);
-	return (0);
+	return (is_stopped(philo->data));
 }
 
 static int	should_continue(t_philo *philo)
 {
-	pthread_mutex_lock(&philo->data->death_mutex);
-	if (philo->data->someone_died)
-	{
-		pthread_mutex_unlock(&philo->data->death_mutex);
+	if (is_stopped(philo->data))
 		return (0);
-	}
-	pthread_mutex_unlock(&philo->data->death_mutex);
 	if (philo->data->max_meals > 0)
 	{
 		pthread_mutex_lock(&philo->meal_mutex);
@@ -83,14 +69,18 @@ void	*routine(void *arg)
 	t_philo	*philo;
 
 	philo = (t_philo *)arg;
+	pin_to_shard(&philo->data->monitors[philo->shard]);
+	perf_start(philo->data, &philo->perf);
 	initial_delay(philo);
 	while (should_continue(philo))
 	{
 		philo_think(philo);
-		take_forks(philo);
+		if (take_forks(philo))
+			break ;
 		philo_eat(philo);
 		drop_forks(philo);
 		philo_sleep(philo);
 	}
+	perf_stop(philo->data, &philo->perf);
 	return (NULL);
 }
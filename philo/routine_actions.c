@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/21 15:35:14 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/22 19:40:16 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 09:50:24 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,36 +20,44 @@ void	philo_think(t_philo *philo)
 void	philo_eat(t_philo *philo)
 {
 	update_meal_info(philo);
-	ft_usleep(philo->data->time_to_eat);
+	precise_sleep(philo, philo->time_to_eat);
 }
 
 void	philo_sleep(t_philo *philo)
 {
 	print_action_ts(philo, "is sleeping");
-	ft_usleep(philo->data->time_to_sleep);
+	precise_sleep(philo, philo->time_to_sleep);
 }
 
-void	take_forks(t_philo *philo)
+int	take_forks(t_philo *philo)
 {
+	pthread_mutex_t	*first;
+	pthread_mutex_t	*second;
+
+	if (FORK_BITMASK)
+		return (take_fork_pair(philo));
+	first = philo->left_fork;
+	second = philo->right_fork;
 	if (philo->id % 2 == 0)
 	{
-		pthread_mutex_lock(philo->right_fork);
-		print_action_ts(philo, "has taken a fork");
-		pthread_mutex_lock(philo->left_fork);
-		print_action_ts(philo, "has taken a fork");
+		first = philo->right_fork;
+		second = philo->left_fork;
 	}
-	else
+	if (take_fork(philo, first))
+		return (1);
+	if (take_fork(philo, second))
 	{
-		pthread_mutex_lock(philo->left_fork);
-		print_action_ts(philo, "has taken a fork");
-		pthread_mutex_lock(philo->right_fork);
-		print_action_ts(philo, "has taken a fork");
+		pthread_mutex_unlock(first);
+		return (1);
 	}
+	return (0);
 }
 
 void	drop_forks(t_philo *philo)
 {
-	if (philo->id % 2 == 0)
+	if (FORK_BITMASK)
+		drop_fork_pair(philo);
+	else if (philo->id % 2 == 0)
 	{
 		pthread_mutex_unlock(philo->left_fork);
 		pthread_mutex_unlock(philo->right_fork);
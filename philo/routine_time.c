@@ -6,7 +6,7 @@
 /*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/21 15:33:47 by radubos           #+#    #+#             */
-/*   Updated: 2025/08/22 19:25:52 by radubos          ###   ########.fr       */
+/*   Updated: 2026/10/19 10:13:04 by radubos          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,24 +15,19 @@
 void	precise_sleep(t_philo *philo, long duration)
 {
 	long	start_time;
-	long	elapsed;
 	long	remaining;
 
 	start_time = get_current_time();
-	while (1)
+	while (!check_death_during_sleep(philo))
 	{
-		if (check_death_during_sleep(philo))
-			return ;
-		elapsed = get_current_time() - start_time;
-		if (elapsed >= duration)
+		remaining = duration - (get_current_time() - start_time);
+		if (remaining <= 0)
 			break ;
-		remaining = duration - elapsed;
-		if (remaining > 200)
-			usleep(100);
-		else if (remaining > 20)
-			usleep(10);
+		if (remaining > 1)
+			futex_wait(&philo->data->someone_died, 0,
+				(remaining - 1) * 1000);
 		else
-			usleep(1);
+			usleep(100);
 	}
 }
 
@@ -42,5 +37,37 @@ void	initial_delay(t_philo *philo)
 
 	data = philo->data;
 	if (data->nb_philos > 1 && philo->id % 2 == 0)
-		ft_usleep(data->time_to_eat / 2);
+		precise_sleep(philo, philo->time_to_eat / 2);
+}
+
+static int	timed_lock(t_philo *philo, pthread_mutex_t *mutex)
+{
+	struct timespec	deadline;
+
+	while (1)
+	{
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_nsec += FORK_WAIT_US * 1000L;
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+		if (pthread_mutex_timedlock(mutex, &deadline) == 0)
+			return (0);
+		if (check_death_during_sleep(philo))
+			return (1);
+	}
+}
+
+int	take_fork(t_philo *philo, pthread_mutex_t *fork)
+{
+	int	index;
+
+	index = fork - philo->data->forks;
+	if (wait_grant_turn(philo, index) || timed_lock(philo, fork))
+		return (1);
+	record_grant(philo, index);
+	print_action_ts(philo, "has taken a fork");
+	return (0);
 }
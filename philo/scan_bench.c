@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scan_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:31:53 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:31:53 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static long	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+static double	time_scan(t_scan scan, long *deadlines, int n)
+{
+	volatile long	sink;
+	long			start;
+	int				rounds;
+	int				i;
+
+	rounds = 100000000 / n + 1;
+	sink = 0;
+	start = now_ns();
+	i = 0;
+	while (i++ < rounds)
+		sink += scan(deadlines, n);
+	(void)sink;
+	return ((now_ns() - start) / 1000.0 / rounds);
+}
+
+static void	bench_size(int n)
+{
+	long	*deadlines;
+	int		i;
+
+	deadlines = malloc(sizeof(long) * n);
+	if (!deadlines)
+		return ;
+	i = 0;
+	while (i < n)
+	{
+		deadlines[i] = 1000000 + (i * 7919L) % n;
+		i++;
+	}
+	printf("%6d deadlines  scalar %8.3f us  dispatched %8.3f us\n", n,
+		time_scan(min_deadline_scalar, deadlines, n),
+		time_scan(select_deadline_scan(), deadlines, n));
+	free(deadlines);
+}
+
+static const char	*scan_name(void)
+{
+	t_scan	scan;
+
+	scan = select_deadline_scan();
+	if (scan == min_deadline_scalar)
+		return ("scalar");
+#if defined(__x86_64__)
+	if (__builtin_cpu_supports("avx2"))
+		return ("avx2");
+#endif
+	return ("sse4.2");
+}
+
+int	main(int argc, char **argv)
+{
+	int	n;
+	int	i;
+
+	printf("dispatched scan: %s\n", scan_name());
+	i = 1;
+	while (i < argc)
+	{
+		n = ft_atoi(argv[i++]);
+		if (n > 0)
+			bench_size(n);
+	}
+	return (0);
+}
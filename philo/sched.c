@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:39:39 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:21:27 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	grow_trace(t_trace *trace)
+{
+	t_grant	*grants;
+	int		i;
+
+	grants = malloc(sizeof(t_grant) * (trace->cap * 2 + TRACE_CHUNK));
+	if (!grants)
+		return (1);
+	i = 0;
+	while (i < trace->len)
+	{
+		grants[i] = trace->grants[i];
+		i++;
+	}
+	free(trace->grants);
+	trace->grants = grants;
+	trace->cap = trace->cap * 2 + TRACE_CHUNK;
+	return (0);
+}
+
+static int	is_turn(t_sched *sched, int id, int fork)
+{
+	int	seq;
+
+	seq = __atomic_load_n(&sched->seq, __ATOMIC_ACQUIRE);
+	return (seq >= sched->len
+		|| (sched->order[seq].philo == id && sched->order[seq].fork == fork));
+}
+
+int	wait_grant_turn(t_philo *philo, int fork)
+{
+	t_sched	*sched;
+
+	sched = &philo->data->sched;
+	if (sched->mode != SCHED_REPLAY)
+		return (0);
+	while (!is_turn(sched, philo->id, fork))
+	{
+		if (check_death_during_sleep(philo))
+			return (1);
+		usleep(REPLAY_POLL_US);
+	}
+	return (0);
+}
+
+void	record_grant(t_philo *philo, int fork)
+{
+	t_sched	*sched;
+	t_trace	*trace;
+	int		seq;
+
+	sched = &philo->data->sched;
+	trace = &philo->trace;
+	if (sched->mode == SCHED_OFF)
+		return ;
+	seq = __atomic_fetch_add(&sched->seq, 1, __ATOMIC_ACQ_REL);
+	if (sched->mode != SCHED_RECORD)
+		return ;
+	if (trace->len == trace->cap && grow_trace(trace))
+	{
+		__atomic_store_n(&sched->failed, 1, __ATOMIC_RELAXED);
+		return ;
+	}
+	trace->grants[trace->len].seq = seq;
+	trace->grants[trace->len].philo = philo->id;
+	trace->grants[trace->len].fork = fork;
+	trace->len++;
+}
+
+void	free_sched(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		free(data->philos[i].trace.grants);
+		i++;
+	}
+	free(data->sched.order);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched_header.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:59:50 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:59:50 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static unsigned int	hash_timings(t_data *data)
+{
+	unsigned int	hash;
+	int				i;
+
+	hash = 2166136261U;
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		hash = (hash ^ data->philos[i].time_to_die) * 16777619U;
+		hash = (hash ^ data->philos[i].time_to_eat) * 16777619U;
+		hash = (hash ^ data->philos[i].time_to_sleep) * 16777619U;
+		i++;
+	}
+	return (hash);
+}
+
+void	fill_header(t_data *data, t_sched_header *head, int len)
+{
+	head->magic = SCHED_MAGIC;
+	head->version = SCHED_VERSION;
+	head->forks = FORK_BITMASK;
+	head->nb_philos = data->nb_philos;
+	head->time_to_die = data->time_to_die;
+	head->time_to_eat = data->time_to_eat;
+	head->time_to_sleep = data->time_to_sleep;
+	head->max_meals = data->max_meals;
+	head->timings = hash_timings(data);
+	head->len = len;
+}
+
+int	check_header(t_data *data, t_sched_header *head, off_t size)
+{
+	t_sched_header	expected;
+
+	if (head->magic != SCHED_MAGIC || head->version != SCHED_VERSION
+		|| head->len < 0 || (size_t)size != sizeof(t_sched_header)
+		+ (size_t)head->len * sizeof(t_grant))
+		return (1);
+	fill_header(data, &expected, head->len);
+	if (memcmp(head, &expected, sizeof(t_sched_header)) != 0)
+		return (2);
+	return (0);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched_io.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:40:20 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:59:50 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	init_sched(t_data *data)
+{
+	t_sched	*sched;
+	int		status;
+
+	sched = &data->sched;
+	sched->mode = SCHED_OFF;
+	sched->seq = 0;
+	sched->len = 0;
+	sched->failed = 0;
+	sched->path = getenv("PHILO_RECORD");
+	if (sched->path)
+		sched->mode = SCHED_RECORD;
+	else if (getenv("PHILO_REPLAY"))
+	{
+		sched->path = getenv("PHILO_REPLAY");
+		sched->mode = SCHED_REPLAY;
+	}
+	status = 0;
+	if (sched->mode == SCHED_REPLAY)
+		status = load_schedule(data);
+	if (status == 2)
+		write(STDERR_FILENO, "Error replay file is for another table\n", 39);
+	else if (status)
+		write(STDERR_FILENO, "Error invalid replay file\n", 26);
+	return (status != 0);
+}
+
+static int	write_exact(int fd, const void *src, size_t size)
+{
+	size_t	done;
+	ssize_t	ret;
+
+	done = 0;
+	while (done < size)
+	{
+		ret = write(fd, (const char *)src + done, size - done);
+		if (ret < 0 && errno == EINTR)
+			continue ;
+		if (ret <= 0)
+			return (1);
+		done += ret;
+	}
+	return (0);
+}
+
+static void	merge_traces(t_data *data, t_grant *all)
+{
+	t_trace	*trace;
+	int		i;
+	int		j;
+
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		trace = &data->philos[i].trace;
+		j = 0;
+		while (j < trace->len)
+		{
+			all[trace->grants[j].seq] = trace->grants[j];
+			j++;
+		}
+		i++;
+	}
+}
+
+void	save_schedule(t_data *data)
+{
+	t_sched_header	head;
+	t_grant			*all;
+	int				fd;
+	int				ok;
+
+	if (data->sched.mode != SCHED_RECORD)
+		return ;
+	all = NULL;
+	fd = -1;
+	if (!data->sched.failed)
+		all = malloc(sizeof(t_grant) * ((size_t)data->sched.seq + 1));
+	if (all)
+		fd = open(data->sched.path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	ok = (fd >= 0);
+	if (ok)
+	{
+		merge_traces(data, all);
+		fill_header(data, &head, data->sched.seq);
+		ok = (!write_exact(fd, &head, sizeof(head))
+				&& !write_exact(fd, all, sizeof(t_grant) * data->sched.seq));
+		close(fd);
+	}
+	if (!ok)
+		write(STDERR_FILENO, "Error invalid record file\n", 26);
+	free(all);
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched_load.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:21:27 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:59:50 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	read_exact(int fd, void *dst, size_t size)
+{
+	size_t	done;
+	ssize_t	ret;
+
+	done = 0;
+	while (done < size)
+	{
+		ret = read(fd, (char *)dst + done, size - done);
+		if (ret <= 0)
+			return (1);
+		done += ret;
+	}
+	return (0);
+}
+
+static int	check_grants(t_data *data, t_grant *order, int len)
+{
+	int	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (order[i].philo < 1 || order[i].philo > data->nb_philos
+			|| order[i].fork < 0 || order[i].fork >= data->nb_philos)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+int	load_schedule(t_data *data)
+{
+	t_sched_header	head;
+	struct stat		st;
+	int				fd;
+	int				status;
+
+	fd = open(data->sched.path, O_RDONLY);
+	if (fd < 0)
+		return (1);
+	status = 1;
+	if (fstat(fd, &st) == 0 && !read_exact(fd, &head, sizeof(head)))
+		status = check_header(data, &head, st.st_size);
+	if (status == 0)
+	{
+		data->sched.len = head.len;
+		data->sched.order = malloc(sizeof(t_grant) * ((size_t)head.len + 1));
+		status = (!data->sched.order || read_exact(fd, data->sched.order,
+					sizeof(t_grant) * (size_t)head.len)
+				|| check_grants(data, data->sched.order, head.len));
+	}
+	close(fd);
+	return (status);
+}
@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stop.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:01:01 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:27:04 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	is_stopped(t_data *data)
+{
+	return (__atomic_load_n(&data->someone_died, __ATOMIC_ACQUIRE));
+}
+
+int	claim_stop(t_data *data)
+{
+	return (__atomic_exchange_n(&data->someone_died, 1, __ATOMIC_ACQ_REL)
+		== 0);
+}
+
+void	wake_sleepers(t_data *data)
+{
+	futex_wake(&data->someone_died);
+	wake_fork_waiters(data);
+}
+
+void	stop_simulation(t_data *data)
+{
+	claim_stop(data);
+	wake_sleepers(data);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timings.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:49:54 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 11:01:31 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	skip_blank(char **s)
+{
+	while (**s == '#' || **s == ' ' || (**s >= 9 && **s <= 13))
+	{
+		if (**s == '#')
+		{
+			while (**s && **s != '\n')
+				(*s)++;
+		}
+		else
+			(*s)++;
+	}
+}
+
+static int	next_number(char **s)
+{
+	long	value;
+
+	skip_blank(s);
+	if (**s == '\0')
+		return (0);
+	if (**s < '0' || **s > '9')
+		return (-1);
+	value = 0;
+	while (**s >= '0' && **s <= '9' && value <= 10000)
+		value = value * 10 + *(*s)++ - '0';
+	if (value <= 0 || value > 10000)
+		return (-1);
+	return (value);
+}
+
+static int	load_timings_file(t_data *data, const char *path)
+{
+	char	*text;
+	char	*s;
+	int		t[3];
+	int		i;
+	int		status;
+
+	text = read_file(path);
+	if (!text)
+		return (1);
+	s = text;
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		t[0] = next_number(&s);
+		t[1] = next_number(&s);
+		t[2] = next_number(&s);
+		if (t[0] <= 0 || t[1] <= 0 || t[2] <= 0)
+			break ;
+		data->philos[i].time_to_die = t[0];
+		data->philos[i].time_to_eat = t[1];
+		data->philos[i].time_to_sleep = t[2];
+		i++;
+	}
+	status = (i < data->nb_philos || next_number(&s) != 0);
+	return (free(text), status);
+}
+
+static void	spread_timings(t_data *data, int pct, unsigned int seed)
+{
+	int	*times[3];
+	int	i;
+	int	j;
+
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		times[0] = &data->philos[i].time_to_die;
+		times[1] = &data->philos[i].time_to_eat;
+		times[2] = &data->philos[i].time_to_sleep;
+		j = 0;
+		while (j < 3)
+		{
+			seed = seed * 1103515245 + 12345;
+			*times[j] = *times[j] * (100 - pct + (seed >> 16) % (2 * pct + 1))
+				/ 100;
+			if (*times[j] < 1)
+				*times[j] = 1;
+			j++;
+		}
+		i++;
+	}
+}
+
+int	init_timings(t_data *data)
+{
+	char	*path;
+	int		pct;
+	int		i;
+
+	path = getenv("PHILO_TIMINGS");
+	if (path && load_timings_file(data, path))
+		return (write(STDERR_FILENO, "Error invalid timings file\n", 27), 1);
+	pct = 0;
+	if (getenv("PHILO_SPREAD"))
+		pct = ft_atoi(getenv("PHILO_SPREAD"));
+	if (pct > 0 && pct < 100 && getenv("PHILO_SEED"))
+		spread_timings(data, pct, ft_atoi(getenv("PHILO_SEED")));
+	else if (pct > 0 && pct < 100)
+		spread_timings(data, pct, 42);
+	i = 0;
+	while (i < data->nb_philos)
+	{
+		data->deadlines[i] = data->start_time + data->philos[i].time_to_die;
+		i++;
+	}
+	return (0);
+}
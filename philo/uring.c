@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   uring.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:15:48 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:15:48 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	prep_write(t_output *out, unsigned int index, int k, int count)
+{
+	struct io_uring_sqe	*sqe;
+	unsigned int		at;
+	int					slot;
+
+	slot = (out->tail + k) % OUT_BUFFERS;
+	at = index & *out->ring.sq_mask;
+	sqe = &out->ring.sqes[at];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = IORING_OP_WRITE_FIXED;
+	sqe->fd = STDOUT_FILENO;
+	sqe->addr = (unsigned long)out->bufs[slot];
+	sqe->len = out->lens[slot];
+	sqe->off = (__u64)-1;
+	sqe->buf_index = slot;
+	sqe->user_data = k;
+	if (k < count - 1)
+		sqe->flags = IOSQE_IO_LINK;
+	out->ring.sq_array[at] = at;
+}
+
+static int	reap(t_uring *ring, int count, size_t *done)
+{
+	struct io_uring_cqe	*cqe;
+	unsigned int		head;
+
+	while (count > 0)
+	{
+		head = *ring->cq_head;
+		if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE))
+		{
+			if (syscall(SYS_io_uring_enter, ring->fd, 0, 1,
+					IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR)
+				return (1);
+			continue ;
+		}
+		cqe = &ring->cqes[head & *ring->cq_mask];
+		if (cqe->res > 0 && cqe->user_data < OUT_BUFFERS)
+			done[cqe->user_data] = cqe->res;
+		__atomic_store_n(ring->cq_head, head + 1, __ATOMIC_RELEASE);
+		count--;
+	}
+	return (0);
+}
+
+void	uring_write(t_output *out, int count, size_t *done)
+{
+	unsigned int	tail;
+	int				k;
+
+	tail = *out->ring.sq_tail;
+	k = 0;
+	while (k < count)
+	{
+		prep_write(out, tail + k, k, count);
+		k++;
+	}
+	__atomic_store_n(out->ring.sq_tail, tail + count, __ATOMIC_RELEASE);
+	if (syscall(SYS_io_uring_enter, out->ring.fd, count, 0, 0, NULL, 0)
+		!= count || reap(&out->ring, count, done))
+		uring_free(&out->ring);
+}
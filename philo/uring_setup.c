@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   uring_setup.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: radubos <radubos@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:15:48 by radubos           #+#    #+#             */
+/*   Updated: 2026/10/19 10:20:33 by radubos          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	set_ring_pointers(t_uring *ring, char *base,
+		struct io_uring_params *p)
+{
+	ring->sq_tail = (unsigned int *)(base + p->sq_off.tail);
+	ring->sq_mask = (unsigned int *)(base + p->sq_off.ring_mask);
+	ring->sq_array = (unsigned int *)(base + p->sq_off.array);
+	ring->cq_head = (unsigned int *)(base + p->cq_off.head);
+	ring->cq_tail = (unsigned int *)(base + p->cq_off.tail);
+	ring->cq_mask = (unsigned int *)(base + p->cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)(base + p->cq_off.cqes);
+	ring->rings = base;
+	ring->entries = p->sq_entries;
+}
+
+static int	map_rings(t_uring *ring, int fd, struct io_uring_params *p)
+{
+	size_t	size;
+	size_t	cq_size;
+	char	*base;
+
+	size = p->sq_off.array + p->sq_entries * sizeof(unsigned int);
+	cq_size = p->cq_off.cqes + p->cq_entries * sizeof(struct io_uring_cqe);
+	if (cq_size > size)
+		size = cq_size;
+	base = mmap(NULL, size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+	if (base == MAP_FAILED)
+		return (1);
+	ring->sqes = mmap(NULL, p->sq_entries * sizeof(struct io_uring_sqe),
+			PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+			IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED)
+		return (munmap(base, size), 1);
+	ring->rings_size = size;
+	set_ring_pointers(ring, base, p);
+	return (0);
+}
+
+static int	register_buffers(t_output *out, int fd)
+{
+	struct iovec	iov[OUT_BUFFERS];
+	int				i;
+
+	i = 0;
+	while (i < OUT_BUFFERS)
+	{
+		iov[i].iov_base = out->bufs[i];
+		iov[i].iov_len = out->cap;
+		i++;
+	}
+	return (syscall(SYS_io_uring_register, fd, IORING_REGISTER_BUFFERS,
+			iov, OUT_BUFFERS) < 0);
+}
+
+void	uring_init(t_output *out)
+{
+	struct io_uring_params	p;
+	int						fd;
+
+	memset(&p, 0, sizeof(p));
+	fd = syscall(SYS_io_uring_setup, OUT_BUFFERS, &p);
+	if (fd < 0)
+		return ;
+	if (!(p.features & IORING_FEAT_SINGLE_MMAP)
+		|| !(p.features & IORING_FEAT_RW_CUR_POS)
+		|| map_rings(&out->ring, fd, &p))
+		return ((void)close(fd));
+	if (register_buffers(out, fd))
+	{
+		out->ring.fd = fd;
+		return (uring_free(&out->ring));
+	}
+	out->ring.fd = fd;
+}
+
+void	uring_free(t_uring *ring)
+{
+	if (ring->fd < 0)
+		return ;
+	munmap(ring->sqes, ring->entries * sizeof(struct io_uring_sqe));
+	munmap(ring->rings, ring->rings_size);
+	close(ring->fd);
+	ring->fd = -1;
+}